@@ -6,6 +6,15 @@
 #ifndef DISPLAY_CONSTANTS_H
 #define DISPLAY_CONSTANTS_H
 
+// -- NJU6432 Serial Bus Minimums (nanoseconds) --
+constexpr unsigned int NJU_T_CLOCK_HIGH_NS = 500; // CLOCK high pulse width
+constexpr unsigned int NJU_T_CLOCK_LOW_NS  = 500; // CLOCK low pulse width
+constexpr unsigned int NJU_T_DATA_SETUP_NS = 200; // DATA stable before CLOCK rises
+constexpr unsigned int NJU_T_DATA_HOLD_NS  = 200; // DATA held after CLOCK rises
+constexpr unsigned int NJU_T_CE_SETUP_NS   = 200; // CHIP_ENABLE rising to first CLOCK rise
+constexpr unsigned int NJU_T_CE_HOLD_NS    = 200; // last CLOCK fall to CHIP_ENABLE falling
+constexpr unsigned int NJU_T_CE_GAP_NS     = 1000; // CHIP_ENABLE low width between blocks
+
 // -- Custom Segment-to-Bit Mapping for 7-Segment Digits --
 constexpr byte SEG_D = 0;
 constexpr byte SEG_H = 1; // Decimal Point
@@ -38,10 +38,16 @@ void Nju6432Display::begin() {
 }
 
 void Nju6432Display::updateDisplay() {
-    // Copy videoRam to transferBuffer
+    // Composite videoRam and visible layers into transferBuffer
     for (int i = 0; i < 14; i++) {
         _transferBuffer[i] = videoRam[i];
     }
+    for (byte l = 0; l < NJU_NUM_LAYERS - 1; l++) {
+        if (!_layerVisible[l]) continue;
+        for (int i = 0; i < 14; i++) {
+            _transferBuffer[i] = (_transferBuffer[i] & ~_layerMask[l][i]) | (_layerContent[l][i] & _layerMask[l][i]);
+        }
+    }
 
     // Perform bit scrambling for bytes 7–13 (S7–S10)
     byte carry = (_transferBuffer[6] >> 5) & 0b00000111;
@@ -58,11 +64,11 @@ void Nju6432Display::updateDisplay() {
     digitalWrite(_chipEnablePin, HIGH);
     sendBlock(0, 6);
     digitalWrite(_dataPin, LOW);
-    delayMicroseconds(1);
+    busDelay(_timing.ceHoldNs);
     digitalWrite(_chipEnablePin, LOW);
-    delayMicroseconds(5);
+    busDelay(_timing.ceGapNs);
     digitalWrite(_chipEnablePin, HIGH);
-    delayMicroseconds(1);
+    busDelay(_timing.ceSetupNs);
     sendBlock(7, 13);
     digitalWrite(_dataPin, LOW);
     digitalWrite(_chipEnablePin, LOW);
@@ -78,46 +84,16 @@ void Nju6432Display::clear() {
     }
 }
 
+// -- BUS TIMING --
+void Nju6432Display::setTiming(const Nju6432Timing& timing) {
+    _timing = timing;
+}
+
 // -- HIGH-LEVEL PRINTING --
 void Nju6432Display::setChar(byte position, char character, bool decimalPoint) {
-    if (position >= NUM_CHAR_POSITIONS) return;
-    int hw_index = NUM_CHAR_POSITIONS - 1 - position; // position 0 -> leftmost (S10), hw_index=9; position 9 -> rightmost (S1), hw_index=0
-
     byte fontPattern = getCharacterFont(character);
     if (decimalPoint) fontPattern |= (1 << SEG_H);
-
-    if (hw_index <= 5) { // S1-S6 (rightmost, normal bytes)
-        videoRam[hw_index] = fontPattern;
-    } else { // S7-S10 (leftmost, split bytes)
-        byte mainByte = 0;
-        byte b_segment = (fontPattern & (1 << SEG_B)) ? 1 : 0;
-
-        if (hw_index == 6) { // S7, special mapping with skip at bit 4
-            videoRam[hw_index] = 0; // Fully clear, no previous B to preserve
-            mainByte |= (fontPattern & (1 << SEG_D)) ? (1 << 0) : 0;
-            mainByte |= (fontPattern & (1 << SEG_H)) ? (1 << 1) : 0;
-            mainByte |= (fontPattern & (1 << SEG_E)) ? (1 << 2) : 0;
-            mainByte |= (fontPattern & (1 << SEG_C)) ? (1 << 3) : 0;
-            mainByte |= (fontPattern & (1 << SEG_F)) ? (1 << 5) : 0;
-            mainByte |= (fontPattern & (1 << SEG_A)) ? (1 << 6) : 0;
-            mainByte |= (fontPattern & (1 << SEG_G)) ? (1 << 7) : 0;
-            videoRam[hw_index] = mainByte;
-            videoRam[hw_index + 1] &= 0b11111110; // Clear B bit
-            videoRam[hw_index + 1] |= b_segment;
-        } else { // S8-S10, standard shifted mapping
-            videoRam[hw_index] &= 0b00000001; // Preserve previous B in bit 0
-            mainByte |= (fontPattern & (1 << SEG_D)) ? (1 << 1) : 0;
-            mainByte |= (fontPattern & (1 << SEG_H)) ? (1 << 2) : 0;
-            mainByte |= (fontPattern & (1 << SEG_E)) ? (1 << 3) : 0;
-            mainByte |= (fontPattern & (1 << SEG_C)) ? (1 << 4) : 0;
-            mainByte |= (fontPattern & (1 << SEG_F)) ? (1 << 5) : 0;
-            mainByte |= (fontPattern & (1 << SEG_A)) ? (1 << 6) : 0;
-            mainByte |= (fontPattern & (1 << SEG_G)) ? (1 << 7) : 0;
-            videoRam[hw_index] |= mainByte;
-            videoRam[hw_index + 1] &= 0b11111110; // Clear B bit
-            videoRam[hw_index + 1] |= b_segment;
-        }
-    }
+    placePattern(videoRam, position, fontPattern);
 }
 
 void Nju6432Display::print(const char* text, byte startPosition) {
@@ -198,6 +174,87 @@ void Nju6432Display::displayTemperature(float temp, byte startPosition) {
     }
 }
 
+// -- LAYERS --
+void Nju6432Display::clearLayer(byte layer) {
+    if (layer == NJU_LAYER_BASE || layer >= NJU_NUM_LAYERS) return;
+    for (int i = 0; i < 14; i++) {
+        _layerContent[layer - 1][i] = 0;
+        _layerMask[layer - 1][i] = 0;
+    }
+}
+
+void Nju6432Display::printLayer(byte layer, const char* text, byte startPosition) {
+    if (layer == NJU_LAYER_BASE || layer >= NJU_NUM_LAYERS) return;
+    if (startPosition >= NUM_CHAR_POSITIONS) return;
+    clearLayer(layer);
+
+    byte currentPos = startPosition;
+    for (int i = 0; text[i] != '\0' && currentPos < NUM_CHAR_POSITIONS; i++) {
+        bool dp = (text[i + 1] == '.');
+        byte fontPattern = getCharacterFont(text[i]);
+        if (dp) fontPattern |= (1 << SEG_H);
+        placePattern(_layerContent[layer - 1], currentPos, fontPattern);
+        placePattern(_layerMask[layer - 1], currentPos, 0xFF); // Cover the whole digit
+        if (dp) i++;
+        currentPos++;
+    }
+}
+
+void Nju6432Display::setLayerIcon(byte layer, byte byteIndex, byte bit, bool on) {
+    if (layer == NJU_LAYER_BASE || layer >= NJU_NUM_LAYERS || byteIndex >= 14) return;
+    _layerMask[layer - 1][byteIndex] |= bit;
+    if (on) {
+        _layerContent[layer - 1][byteIndex] |= bit;
+    } else {
+        _layerContent[layer - 1][byteIndex] &= ~bit;
+    }
+}
+
+void Nju6432Display::setLayerContent(byte layer, const byte* content, const byte* mask) {
+    if (layer == NJU_LAYER_BASE || layer >= NJU_NUM_LAYERS) return;
+    for (int i = 0; i < 14; i++) {
+        _layerContent[layer - 1][i] = content[i];
+        _layerMask[layer - 1][i] = mask[i];
+    }
+}
+
+void Nju6432Display::showLayer(byte layer, unsigned long timeoutMs) {
+    if (layer == NJU_LAYER_BASE || layer >= NJU_NUM_LAYERS) return;
+    _layerVisible[layer - 1] = true;
+    _layerShownAt[layer - 1] = millis();
+    _layerTimeout[layer - 1] = timeoutMs;
+    updateDisplay();
+}
+
+void Nju6432Display::hideLayer(byte layer) {
+    if (layer == NJU_LAYER_BASE || layer >= NJU_NUM_LAYERS) return;
+    if (_layerVisible[layer - 1]) {
+        _layerVisible[layer - 1] = false;
+        updateDisplay();
+    }
+}
+
+bool Nju6432Display::isLayerVisible(byte layer) const {
+    if (layer == NJU_LAYER_BASE) return true;
+    if (layer >= NJU_NUM_LAYERS) return false;
+    return _layerVisible[layer - 1];
+}
+
+bool Nju6432Display::updateLayers() {
+    bool changed = false, anyVisible = false;
+    for (byte l = 0; l < NJU_NUM_LAYERS - 1; l++) {
+        if (!_layerVisible[l]) continue;
+        if (_layerTimeout[l] != 0 && millis() - _layerShownAt[l] >= _layerTimeout[l]) {
+            _layerVisible[l] = false;
+            changed = true;
+        } else {
+            anyVisible = true;
+        }
+    }
+    if (changed) updateDisplay();
+    return anyVisible;
+}
+
 // -- ALL OTHER MODES --
 void Nju6432Display::setBrightness(byte level) {
     if (_inhibitPin == NJU_NO_PIN) {
@@ -424,6 +481,12 @@ void Nju6432Display::stopKnightRider() { _isScanning = false; }
 void Nju6432Display::runDiagnostics(unsigned int delayMs) {
     stopAllModes();
     byte oldBrightness = _brightness;
+    // Hide layers so the test patterns reach the glass unmodified
+    bool oldLayerVisible[NJU_NUM_LAYERS - 1];
+    for (byte l = 0; l < NJU_NUM_LAYERS - 1; l++) {
+        oldLayerVisible[l] = _layerVisible[l];
+        _layerVisible[l] = false;
+    }
     setBrightness(255);
     Serial.println("Diagnostics: Lighting all segments");
     for (int i = 0; i < 14; i++) videoRam[i] = 0xFF;
@@ -440,6 +503,9 @@ void Nju6432Display::runDiagnostics(unsigned int delayMs) {
         delay(delayMs / 2);
     }
     clear();
+    for (byte l = 0; l < NJU_NUM_LAYERS - 1; l++) {
+        _layerVisible[l] = oldLayerVisible[l];
+    }
     updateDisplay();
     setBrightness(oldBrightness);
 }
@@ -449,19 +515,76 @@ void Nju6432Display::sendBlock(byte start, byte end) {
     for (byte i = start; i <= end; i++) {
         for (byte bitPos = 0; bitPos < 8; bitPos++) {
             digitalWrite(_dataPin, bitRead(_transferBuffer[i], bitPos));
-            delayMicroseconds(1);
+            busDelay(_timing.dataSetupNs);
             digitalWrite(_clockPin, HIGH);
-            delayMicroseconds(1);
+            busDelay(_timing.clockHighNs);
             digitalWrite(_clockPin, LOW);
-            delayMicroseconds(1);
+            busDelay(_timing.clockLowNs);
         }
     }
 }
 
+void Nju6432Display::busDelay(unsigned int ns) {
+    if (ns == 0) return;
+#ifdef F_CPU
+    if (ns < 1000) {
+        // Each iteration takes at least one cycle, so this never waits less than ns
+        unsigned long cycles = ((unsigned long)ns * (F_CPU / 1000000UL) + 999) / 1000;
+#ifdef NJU_SPIN_CYCLES
+        NJU_SPIN_CYCLES(cycles);
+#else
+        for (unsigned long i = 0; i < cycles; i++) {
+            __asm__ __volatile__("nop");
+        }
+#endif
+        return;
+    }
+#endif
+    delayMicroseconds((ns + 999) / 1000);
+}
+
 void Nju6432Display::applyControlBits(byte bufferIndex, byte controlWord) {
     _transferBuffer[bufferIndex] = (_transferBuffer[bufferIndex] & 0b00011111) | controlWord;
 }
 
+void Nju6432Display::placePattern(byte* buffer, byte position, byte fontPattern) {
+    if (position >= NUM_CHAR_POSITIONS) return;
+    int hw_index = NUM_CHAR_POSITIONS - 1 - position; // position 0 -> leftmost (S10), hw_index=9; position 9 -> rightmost (S1), hw_index=0
+
+    if (hw_index <= 5) { // S1-S6 (rightmost, normal bytes)
+        buffer[hw_index] = fontPattern;
+    } else { // S7-S10 (leftmost, split bytes)
+        byte mainByte = 0;
+        byte b_segment = (fontPattern & (1 << SEG_B)) ? 1 : 0;
+
+        if (hw_index == 6) { // S7, special mapping with skip at bit 4
+            buffer[hw_index] = 0; // Fully clear, no previous B to preserve
+            mainByte |= (fontPattern & (1 << SEG_D)) ? (1 << 0) : 0;
+            mainByte |= (fontPattern & (1 << SEG_H)) ? (1 << 1) : 0;
+            mainByte |= (fontPattern & (1 << SEG_E)) ? (1 << 2) : 0;
+            mainByte |= (fontPattern & (1 << SEG_C)) ? (1 << 3) : 0;
+            mainByte |= (fontPattern & (1 << SEG_F)) ? (1 << 5) : 0;
+            mainByte |= (fontPattern & (1 << SEG_A)) ? (1 << 6) : 0;
+            mainByte |= (fontPattern & (1 << SEG_G)) ? (1 << 7) : 0;
+            buffer[hw_index] = mainByte;
+            buffer[hw_index + 1] &= 0b11111110; // Clear B bit
+            buffer[hw_index + 1] |= b_segment;
+        } else { // S8-S10, standard shifted mapping
+            buffer[hw_index] &= 0b00000001; // Preserve previous B in bit 0
+            mainByte |= (fontPattern & (1 << SEG_D)) ? (1 << 1) : 0;
+            mainByte |= (fontPattern & (1 << SEG_H)) ? (1 << 2) : 0;
+            mainByte |= (fontPattern & (1 << SEG_E)) ? (1 << 3) : 0;
+            mainByte |= (fontPattern & (1 << SEG_C)) ? (1 << 4) : 0;
+            mainByte |= (fontPattern & (1 << SEG_F)) ? (1 << 5) : 0;
+            mainByte |= (fontPattern & (1 << SEG_A)) ? (1 << 6) : 0;
+            mainByte |= (fontPattern & (1 << SEG_G)) ? (1 << 7) : 0;
+            buffer[hw_index] |= mainByte;
+            buffer[hw_index + 1] &= 0b11111110; // Clear B bit
+            buffer[hw_index + 1] |= b_segment;
+        }
+    }
+}
+
 byte Nju6432Display::getCharacterFont(char c) {
     if (c >= '0' && c <= '9') return sevenSegmentFont[c - '0'];
     if (c >= 'a' && c <= 'f') return sevenSegmentFont[c - 'a' + 10];
@@ -13,6 +13,55 @@
 static const byte NJU_NO_PIN = 255; 
 #define NJU_MAX_SCROLL_TEXT_LENGTH 64
 
+// Compositor layers, bottom to top. The base layer is videoRam itself.
+static const byte NJU_LAYER_BASE = 0;
+static const byte NJU_LAYER_OVERLAY = 1;
+static const byte NJU_LAYER_ALERT = 2;
+#define NJU_NUM_LAYERS 3
+
+// Serial bus timing, all values in nanoseconds. A value of 0 skips the
+// delay entirely and relies on the pin-write latency of the MCU.
+// CE setup/hold only apply around the CE gap between the two blocks; at the
+// outer edges of a frame they are covered by dataSetupNs and clockLowNs.
+struct Nju6432Timing {
+    unsigned int dataSetupNs;   // DATA stable before CLOCK rises
+    unsigned int clockHighNs;   // CLOCK high time (also DATA hold after the rising edge)
+    unsigned int clockLowNs;    // CLOCK low time before the next bit
+    unsigned int ceHoldNs;      // first block's last bit to CHIP_ENABLE falling (latch)
+    unsigned int ceGapNs;       // CHIP_ENABLE low time between the two blocks
+    unsigned int ceSetupNs;     // CHIP_ENABLE rising to the second block
+};
+
+// Guaranteed lower bound for one digitalWrite(), in nanoseconds. Only AVR
+// cores are slow enough to rely on; elsewhere every minimum gets a delay.
+// Define before including this header to override for a specific board.
+#ifndef NJU_PIN_WRITE_NS
+#if defined(__AVR__)
+#define NJU_PIN_WRITE_NS 1000
+#else
+#define NJU_PIN_WRITE_NS 0
+#endif
+#endif
+
+// Delay that, together with one pin write, meets minNs.
+constexpr unsigned int njuDelayNs(unsigned int minNs) {
+    return minNs > NJU_PIN_WRITE_NS ? minNs - NJU_PIN_WRITE_NS : 0;
+}
+constexpr unsigned int njuMaxNs(unsigned int a, unsigned int b) { return a > b ? a : b; }
+
+// Timing used by earlier versions of the library.
+static const Nju6432Timing NJU_TIMING_STANDARD = {1000, 1000, 1000, 1000, 5000, 1000};
+// Delays only where a single pin write cannot be shown to meet the NJU6432
+// minimums (all zero on AVR). Sub-microsecond delays are cycle-counted.
+static const Nju6432Timing NJU_TIMING_FAST = {
+    njuDelayNs(njuMaxNs(NJU_T_DATA_SETUP_NS, NJU_T_CE_SETUP_NS)),
+    njuDelayNs(njuMaxNs(NJU_T_CLOCK_HIGH_NS, NJU_T_DATA_HOLD_NS)),
+    njuDelayNs(njuMaxNs(NJU_T_CLOCK_LOW_NS, NJU_T_CE_HOLD_NS)),
+    0,
+    njuDelayNs(NJU_T_CE_GAP_NS),
+    0
+};
+
 class Nju6432Display {
 public:
     // -- Constructors --
@@ -26,6 +75,10 @@ public:
     void updateDisplay();
     void clear();
 
+    // -- Bus Timing --
+    void setTiming(const Nju6432Timing& timing);
+    const Nju6432Timing& getTiming() const { return _timing; }
+
     // -- High-Level "Framebuffer" Functions --
     void setChar(byte position, char character, bool decimalPoint = false);
     void print(const char* text, byte startPosition = 0);
@@ -57,6 +110,16 @@ public:
     bool updateKnightRider();
     void stopKnightRider();
 
+    // -- Layers (overlay/alert drawn over videoRam) --
+    void clearLayer(byte layer);
+    void printLayer(byte layer, const char* text, byte startPosition = 0);
+    void setLayerIcon(byte layer, byte byteIndex, byte bit, bool on = true);
+    void setLayerContent(byte layer, const byte* content, const byte* mask);
+    void showLayer(byte layer, unsigned long timeoutMs = 0); // 0 = no timeout
+    void hideLayer(byte layer);
+    bool isLayerVisible(byte layer) const;
+    bool updateLayers();
+
     // -- Diagnostics --
     void runDiagnostics(unsigned int delayMs = 100);
 
@@ -66,8 +129,10 @@ public:
 private:
     // -- Internal Members & Functions --
     void sendBlock(byte start, byte end);
+    static void busDelay(unsigned int ns);
     void applyControlBits(byte bufferIndex, byte controlWord);
     byte getCharacterFont(char c);
+    void placePattern(byte* buffer, byte position, byte fontPattern);
     void stopAllModes();
 
     // Pin assignments
@@ -77,6 +142,7 @@ private:
     static const byte CONTROL_BLOCK_0 = 0b00100000;
     static const byte CONTROL_BLOCK_1 = 0b10000000;
     byte _transferBuffer[14] = {0};
+    Nju6432Timing _timing = NJU_TIMING_STANDARD;
     
     // State management for all non-blocking modes
     byte _brightness = 255;
@@ -103,6 +169,13 @@ private:
     unsigned int _scannerSpeed = 50;
     unsigned long _lastScanTime = 0;
 
+    // Overlay/alert layers; index 0 is NJU_LAYER_OVERLAY
+    byte _layerContent[NJU_NUM_LAYERS - 1][14] = {{0}};
+    byte _layerMask[NJU_NUM_LAYERS - 1][14] = {{0}};
+    bool _layerVisible[NJU_NUM_LAYERS - 1] = {false};
+    unsigned long _layerShownAt[NJU_NUM_LAYERS - 1] = {0};
+    unsigned long _layerTimeout[NJU_NUM_LAYERS - 1] = {0};
+
         // Track length of last temperature displayed at each position
     byte _lastTempLength[10] = {0}; // One for each display position
 };
@@ -0,0 +1,72 @@
+/*
+ * File: Arduino.h
+ * Minimal host stand-in for the Arduino core, used by the host tests.
+ * Time is simulated in nanoseconds: every digitalWrite() costs
+ * STUB_PIN_WRITE_NS (set independently of the library's NJU_PIN_WRITE_NS
+ * assumption), delays advance the clock exactly and NJU_SPIN_CYCLES waits
+ * cycles at F_CPU. Pin level changes are recorded with their timestamp.
+ */
+#ifndef HOST_ARDUINO_STUB_H
+#define HOST_ARDUINO_STUB_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <vector>
+
+#ifndef STUB_PIN_WRITE_NS
+#define STUB_PIN_WRITE_NS 0
+#endif
+#ifndef F_CPU
+#define F_CPU 240000000UL
+#endif
+#define NJU_SPIN_CYCLES(cycles) stubSpinCycles(cycles)
+
+typedef uint8_t byte;
+
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+
+struct PinEdge {
+    unsigned long long timeNs;
+    byte pin;
+    byte level;
+};
+
+inline unsigned long long& stubNowNs() { static unsigned long long now = 0; return now; }
+inline byte* stubPinLevels() { static byte levels[256] = {0}; return levels; }
+inline std::vector<PinEdge>& stubEdges() { static std::vector<PinEdge> edges; return edges; }
+
+inline void pinMode(byte, byte) {}
+inline void digitalWrite(byte pin, byte level) {
+    if (stubPinLevels()[pin] != level) {
+        stubPinLevels()[pin] = level;
+        stubEdges().push_back({stubNowNs(), pin, level});
+    }
+    stubNowNs() += STUB_PIN_WRITE_NS;
+}
+inline void stubSpinCycles(unsigned long cycles) { stubNowNs() += (cycles * 1000000000ULL) / F_CPU; }
+inline void analogWrite(byte, int) {}
+inline void delayMicroseconds(unsigned int us) { stubNowNs() += us * 1000ULL; }
+inline void delay(unsigned long ms) { stubNowNs() += ms * 1000000ULL; }
+inline unsigned long millis() { return (unsigned long)(stubNowNs() / 1000000ULL); }
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+inline char* dtostrf(double val, signed char width, unsigned char prec, char* out) {
+    sprintf(out, "%*.*f", width, prec, val);
+    return out;
+}
+
+struct StubSerial {
+    template <typename T> void print(T) {}
+    template <typename T> void println(T) {}
+    void println() {}
+};
+inline StubSerial& stubSerial() { static StubSerial serial; return serial; }
+#define Serial stubSerial()
+
+#endif // HOST_ARDUINO_STUB_H
@@ -0,0 +1,40 @@
+/*
+ * File: BusCapture.h
+ * Decodes the frame clocked out on the stub's recorded pin edges.
+ */
+#ifndef HOST_BUS_CAPTURE_H
+#define HOST_BUS_CAPTURE_H
+
+#include "Arduino.h"
+
+static const byte DATA_PIN = 1;
+static const byte CLOCK_PIN = 2;
+static const byte CHIP_ENABLE_PIN = 3;
+
+// Forget previously recorded edges; the next frame starts from here.
+inline void startCapture(byte& dataLevel) {
+    dataLevel = stubPinLevels()[DATA_PIN];
+    stubEdges().clear();
+}
+
+// Rebuilds the 14-byte transfer buffer (LSB first) from the first frame
+// recorded since startCapture(). Returns the number of bits seen.
+inline int captureFrame(byte dataLevel, byte frame[14]) {
+    int bits = 0;
+    bool ceHigh = false;
+    memset(frame, 0, 14);
+    for (const PinEdge& e : stubEdges()) {
+        if (e.pin == DATA_PIN) {
+            dataLevel = e.level;
+        } else if (e.pin == CHIP_ENABLE_PIN) {
+            ceHigh = e.level == HIGH;
+        } else if (e.pin == CLOCK_PIN && e.level == HIGH && ceHigh) {
+            if (bits >= 14 * 8) break;
+            if (dataLevel) frame[bits / 8] |= (1 << (bits % 8));
+            bits++;
+        }
+    }
+    return bits;
+}
+
+#endif // HOST_BUS_CAPTURE_H
@@ -0,0 +1,126 @@
+/*
+ * Host test: drives updateDisplay() against the stub core and checks every
+ * recorded bus interval against the NJU6432 minimums in DisplayConstants.h.
+ * Build with EXPECT_FAST_VIOLATIONS=1 when the stub's pin write is faster
+ * than the library assumes; the fast preset must then be flagged.
+ */
+#include "Nju6432Display.h"
+#include "BusCapture.h"
+
+#ifndef EXPECT_FAST_VIOLATIONS
+#define EXPECT_FAST_VIOLATIONS 0
+#endif
+
+static const long long NONE = -1;
+
+static int failures = 0;
+
+static void expectMin(const char* preset, const char* what, long long timeNs, long long intervalNs, unsigned int minNs) {
+    if (intervalNs < (long long)minNs) {
+        printf("FAIL [%s] %s at %lld ns: %lld ns < %u ns\n", preset, what, timeNs, intervalNs, minNs);
+        failures++;
+    }
+}
+
+static void checkFrame(const char* preset) {
+    long long lastData = NONE, lastClkRise = NONE, lastClkFall = NONE;
+    long long lastCeRise = NONE, lastCeFall = NONE;
+    bool ceHigh = false, clkHigh = false, firstClock = false;
+    int clockPulses = 0;
+
+    for (const PinEdge& e : stubEdges()) {
+        long long t = (long long)e.timeNs;
+        if (e.pin == DATA_PIN) {
+            if (lastClkRise != NONE) expectMin(preset, "data hold", t, t - lastClkRise, NJU_T_DATA_HOLD_NS);
+            lastData = t;
+        } else if (e.pin == CLOCK_PIN && e.level == HIGH) {
+            if (!ceHigh) { printf("FAIL [%s] clock rise with CE low at %lld ns\n", preset, t); failures++; }
+            if (lastData != NONE) expectMin(preset, "data setup", t, t - lastData, NJU_T_DATA_SETUP_NS);
+            if (lastClkFall != NONE) expectMin(preset, "clock low", t, t - lastClkFall, NJU_T_CLOCK_LOW_NS);
+            if (firstClock) expectMin(preset, "CE setup", t, t - lastCeRise, NJU_T_CE_SETUP_NS);
+            firstClock = false;
+            clkHigh = true;
+            lastClkRise = t;
+            clockPulses++;
+        } else if (e.pin == CLOCK_PIN) {
+            expectMin(preset, "clock high", t, t - lastClkRise, NJU_T_CLOCK_HIGH_NS);
+            clkHigh = false;
+            lastClkFall = t;
+        } else if (e.pin == CHIP_ENABLE_PIN && e.level == HIGH) {
+            if (lastCeFall != NONE) expectMin(preset, "CE gap", t, t - lastCeFall, NJU_T_CE_GAP_NS);
+            ceHigh = true;
+            firstClock = true;
+            lastCeRise = t;
+        } else if (e.pin == CHIP_ENABLE_PIN) {
+            if (clkHigh) { printf("FAIL [%s] CE fall with clock high at %lld ns\n", preset, t); failures++; }
+            if (lastClkFall != NONE) expectMin(preset, "CE hold", t, t - lastClkFall, NJU_T_CE_HOLD_NS);
+            ceHigh = false;
+            lastCeFall = t;
+        }
+    }
+
+    if (clockPulses != 14 * 8) {
+        printf("FAIL [%s] expected %d clock pulses, got %d\n", preset, 14 * 8, clockPulses);
+        failures++;
+    }
+}
+
+// Runs four frames with the given timing; returns the violations found and
+// the duration of the last frame.
+static int runPreset(const char* preset, const Nju6432Timing& timing, unsigned long long& frameNs) {
+    int failuresBefore = failures;
+    Nju6432Display display(DATA_PIN, CLOCK_PIN, CHIP_ENABLE_PIN);
+    display.begin();
+    display.setTiming(timing);
+
+    // Alternating patterns so DATA changes on (almost) every bit
+    static const byte patterns[] = {0xAA, 0x55, 0xFF, 0x00};
+    for (byte p = 0; p < sizeof(patterns); p++) {
+        for (int i = 0; i < 14; i++) display.videoRam[i] = patterns[p] ^ (i & 1 ? 0xFF : 0x00);
+        stubEdges().clear();
+        unsigned long long start = stubNowNs();
+        display.updateDisplay();
+        checkFrame(preset);
+        frameNs = stubNowNs() - start;
+        printf("[%s] pattern 0x%02X: frame %llu ns\n", preset, patterns[p], frameNs);
+    }
+    return failures - failuresBefore;
+}
+
+int main() {
+    printf("Library assumes %d ns per pin write, stub charges %d ns\n", NJU_PIN_WRITE_NS, STUB_PIN_WRITE_NS);
+    unsigned long long standardNs = 0, fastNs = 0;
+    int standardFailures = runPreset("standard", NJU_TIMING_STANDARD, standardNs);
+    int fastFailures = runPreset("fast", NJU_TIMING_FAST, fastNs);
+
+    if (standardFailures) {
+        printf("%d timing violation(s) in the standard preset\n", standardFailures);
+        return 1;
+    }
+#if EXPECT_FAST_VIOLATIONS
+    if (fastFailures == 0) {
+        printf("FAIL: pin writes faster than NJU_PIN_WRITE_NS were not flagged\n");
+        return 1;
+    }
+    printf("Fast preset flagged as expected (%d violation(s))\n", fastFailures);
+#else
+    if (fastFailures) {
+        printf("%d timing violation(s) in the fast preset\n", fastFailures);
+        return 1;
+    }
+    // The fast frame may only spend what the pin writes and the remaining
+    // shortfall to the minimums require: no rounding up to whole microseconds.
+    const unsigned long long cycleNs = 1000000000ULL / F_CPU + 1;
+    const unsigned long long bitBudget = 3ULL * STUB_PIN_WRITE_NS + NJU_TIMING_FAST.dataSetupNs
+        + NJU_TIMING_FAST.clockHighNs + NJU_TIMING_FAST.clockLowNs + 3 * cycleNs;
+    const unsigned long long frameBudget = 14 * 8 * bitBudget + 8ULL * STUB_PIN_WRITE_NS
+        + NJU_TIMING_FAST.ceHoldNs + NJU_TIMING_FAST.ceGapNs + NJU_TIMING_FAST.ceSetupNs + 3 * cycleNs;
+    if (fastNs >= standardNs || fastNs > frameBudget) {
+        printf("FAIL: fast frame %llu ns (standard %llu ns, budget %llu ns)\n", fastNs, standardNs, frameBudget);
+        return 1;
+    }
+    printf("Fast frame %llu ns vs standard %llu ns\n", fastNs, standardNs);
+#endif
+    printf("All bus timing checks passed\n");
+    return 0;
+}
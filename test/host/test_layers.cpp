@@ -0,0 +1,153 @@
+/*
+ * Host test: checks the frames encoded with overlay/alert layers against
+ * frames encoded from plain videoRam, plus layer expiry and diagnostics.
+ */
+#include "Nju6432Display.h"
+#include "BusCapture.h"
+
+static int failures = 0;
+
+#define CHECK(cond, msg) \
+    do { if (!(cond)) { printf("FAIL line %d: %s\n", __LINE__, msg); failures++; } } while (0)
+
+// Encodes the current state of the display and returns the decoded frame.
+static void encode(Nju6432Display& display, byte frame[14]) {
+    byte dataLevel;
+    startCapture(dataLevel);
+    display.updateDisplay();
+    CHECK(captureFrame(dataLevel, frame) == 14 * 8, "incomplete frame");
+}
+
+// Base readout with the icons on bytes 10-12 lit.
+static void drawBase(Nju6432Display& display) {
+    display.print("8.8.8.8.8.8.8.8.8.8.");
+    display.videoRam[ICON_ENTER_BYTE] |= ICON_ENTER_BIT | ICON_UPPER_P_BIT;
+    display.videoRam[ICON_UPPER_EQUAL_BYTE] |= ICON_UPPER_EQUAL_BIT | ICON_BATTERY_SEG_4_BIT;
+    display.videoRam[ICON_BATTERY_BYTE] |= ICON_BATTERY_SHELL | ICON_BATTERY_SEG_1;
+}
+
+static void testAlertOverBase() {
+    Nju6432Display display(DATA_PIN, CLOCK_PIN, CHIP_ENABLE_PIN);
+    Nju6432Display reference(DATA_PIN, CLOCK_PIN, CHIP_ENABLE_PIN);
+    display.begin();
+    reference.begin();
+    drawBase(display);
+    drawBase(reference);
+
+    byte baseFrame[14], frame[14], expected[14];
+    encode(display, baseFrame);
+
+    // Positions 1-4 are S9, S8, S7 and S6: crosses the S7-S10 split bytes
+    // and leaves S10 (including its B bit in byte 10) and the icons uncovered.
+    display.printLayer(NJU_LAYER_ALERT, "HELP", 1);
+    display.showLayer(NJU_LAYER_ALERT);
+    encode(display, frame);
+
+    reference.setChar(1, 'H');
+    reference.setChar(2, 'E');
+    reference.setChar(3, 'L');
+    reference.setChar(4, 'P');
+    encode(reference, expected);
+
+    CHECK(memcmp(frame, expected, 14) == 0, "alert frame differs from setChar reference");
+    CHECK(memcmp(frame, baseFrame, 14) != 0, "alert layer had no effect");
+    // Bytes 10-13 are shifted by 3 bits in the transfer buffer: icons and
+    // the S10 B bit end up in bytes 10-13 and must match the base frame.
+    for (int i = 10; i < 14; i++) {
+        CHECK(frame[i] == baseFrame[i], "uncovered icon/S10 bits changed");
+    }
+
+    display.hideLayer(NJU_LAYER_ALERT);
+    encode(display, frame);
+    CHECK(memcmp(frame, baseFrame, 14) == 0, "hiding the alert did not restore the base frame");
+}
+
+static void testAlertWinsOverOverlay() {
+    Nju6432Display display(DATA_PIN, CLOCK_PIN, CHIP_ENABLE_PIN);
+    display.begin();
+    drawBase(display);
+
+    byte overlayFrame[14], alertFrame[14], frame[14];
+    display.printLayer(NJU_LAYER_OVERLAY, "1111", 1);
+    display.setLayerIcon(NJU_LAYER_OVERLAY, ICON_BATTERY_BYTE, ICON_BATTERY_SHELL, false);
+    display.printLayer(NJU_LAYER_ALERT, "HELP", 1);
+    display.setLayerIcon(NJU_LAYER_ALERT, ICON_BATTERY_BYTE, ICON_BATTERY_SHELL, true);
+
+    display.showLayer(NJU_LAYER_OVERLAY);
+    encode(display, overlayFrame);
+    display.hideLayer(NJU_LAYER_OVERLAY);
+    display.showLayer(NJU_LAYER_ALERT);
+    encode(display, alertFrame);
+
+    display.showLayer(NJU_LAYER_OVERLAY);
+    encode(display, frame);
+    CHECK(memcmp(frame, alertFrame, 14) == 0, "alert does not win over overlay");
+
+    display.hideLayer(NJU_LAYER_ALERT);
+    encode(display, frame);
+    CHECK(memcmp(frame, overlayFrame, 14) == 0, "overlay not shown after hiding alert");
+}
+
+static void testTimeout() {
+    Nju6432Display display(DATA_PIN, CLOCK_PIN, CHIP_ENABLE_PIN);
+    display.begin();
+    drawBase(display);
+    byte ramBefore[14];
+    memcpy(ramBefore, display.videoRam, 14);
+
+    byte baseFrame[14], frame[14];
+    encode(display, baseFrame);
+
+    // Align to a millisecond boundary so millis() deltas are exact
+    stubNowNs() = (stubNowNs() / 1000000ULL + 1) * 1000000ULL;
+    display.printLayer(NJU_LAYER_ALERT, "HOT");
+    display.showLayer(NJU_LAYER_ALERT, 100);
+
+    delay(99);
+    CHECK(display.updateLayers(), "updateLayers reports no visible layer before timeout");
+    CHECK(display.isLayerVisible(NJU_LAYER_ALERT), "alert expired early");
+
+    delay(1);
+    byte dataLevel;
+    startCapture(dataLevel);
+    CHECK(!display.updateLayers(), "updateLayers reports a visible layer after timeout");
+    CHECK(!display.isLayerVisible(NJU_LAYER_ALERT), "alert did not expire at timeout");
+    CHECK(captureFrame(dataLevel, frame) == 14 * 8, "expiry did not refresh the display");
+    CHECK(memcmp(frame, baseFrame, 14) == 0, "expiry did not restore the base frame");
+    CHECK(memcmp(display.videoRam, ramBefore, 14) == 0, "videoRam modified by layers");
+}
+
+static void testDiagnosticsRestoresLayers() {
+    Nju6432Display display(DATA_PIN, CLOCK_PIN, CHIP_ENABLE_PIN);
+    Nju6432Display reference(DATA_PIN, CLOCK_PIN, CHIP_ENABLE_PIN);
+    display.begin();
+    reference.begin();
+
+    byte allOn[14], frame[14];
+    for (int i = 0; i < 14; i++) reference.videoRam[i] = 0xFF;
+    encode(reference, allOn);
+
+    display.printLayer(NJU_LAYER_OVERLAY, "    ");
+    display.showLayer(NJU_LAYER_OVERLAY);
+
+    byte dataLevel;
+    startCapture(dataLevel);
+    display.runDiagnostics(10);
+    captureFrame(dataLevel, frame); // First frame is the all-segments pattern
+    CHECK(memcmp(frame, allOn, 14) == 0, "overlay drawn over the diagnostics pattern");
+    CHECK(display.isLayerVisible(NJU_LAYER_OVERLAY), "overlay not restored after diagnostics");
+    CHECK(!display.isLayerVisible(NJU_LAYER_ALERT), "alert shown after diagnostics");
+}
+
+int main() {
+    testAlertOverBase();
+    testAlertWinsOverOverlay();
+    testTimeout();
+    testDiagnosticsRestoresLayers();
+    if (failures) {
+        printf("%d layer check(s) failed\n", failures);
+        return 1;
+    }
+    printf("All layer checks passed\n");
+    return 0;
+}